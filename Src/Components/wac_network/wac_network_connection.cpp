@@ -319,6 +319,56 @@ void WAC_Network_Connection::run( size_t max_send_bytes, size_t max_recv_bytes,
 	}
 }
 
+/* blocks until there is something for run() to do or timeout_ms elapses, so callers don't have to Sleep() between run() calls.
+returns 1 if the socket is ready (or the state changed), 0 on timeout, -1 on error */
+int WAC_Network_Connection::wait( int timeout_ms )
+{
+	fd_set f[ 3 ];
+	FD_ZERO( &f[ 0 ] );
+	FD_ZERO( &f[ 1 ] );
+	FD_ZERO( &f[ 2 ] );
+
+	switch ( m_state )
+	{
+		case STATE_RESOLVING:
+		case STATE_RESOLVED:
+			// DNS is resolved on another thread so we have no socket to wait on yet.  nap briefly and let run() check on it
+			if ( timeout_ms > 10 )
+				timeout_ms = 10;
+
+			Sleep( timeout_ms );
+			return 1;
+		case STATE_CONNECTING:
+			FD_SET( m_socket, &f[ 1 ] );
+			FD_SET( m_socket, &f[ 2 ] );
+			break;
+		case STATE_CONNECTED:
+		case STATE_CLOSING:
+			if ( recv_buffer.avail() )
+				FD_SET( m_socket, &f[ 0 ] );
+
+			if ( !send_buffer.empty() )
+				FD_SET( m_socket, &f[ 1 ] );
+
+			if ( !FD_ISSET( m_socket, &f[ 0 ] ) && !FD_ISSET( m_socket, &f[ 1 ] ) )
+				return 1; // receive buffer is full and nothing to send, so waiting won't accomplish anything
+
+			break;
+		default:
+			return -1;
+	}
+
+	struct timeval tv;
+	tv.tv_sec  = timeout_ms / 1000;
+	tv.tv_usec = ( timeout_ms % 1000 ) * 1000;
+
+	int ret = select( (int)m_socket + 1, &f[ 0 ], &f[ 1 ], &f[ 2 ], timeout_ms < 0 ? NULL : &tv );
+	if ( ret == -1 )
+		return -1;
+
+	return ret ? 1 : 0;
+}
+
 void WAC_Network_Connection::on_socket_connected( void )
 {
 	return;
@@ -101,6 +101,7 @@ public:
     **  Need to make this virtual to ensure SSL can init properly
     */
     virtual void run( size_t max_send_bytes = -1, size_t max_recv_bytes = -1, size_t *bytes_sent = NULL, size_t *bytes_rcvd = NULL );
+    virtual int wait( int timeout_ms ); // waits for socket readiness. returns 1 if run() has work to do, 0 on timeout, -1 on error
     int  get_state()
     {
         return m_state;
@@ -515,6 +515,14 @@ char *wa::Components::WAC_Network_HTTPGet::getheader( const char *headername )
 	return ret;
 }
 
+int wa::Components::WAC_Network_HTTPGet::wait( int timeout_ms )
+{
+	if ( m_http_state == -1 || !m_con )
+		return HTTPRECEIVER_WAIT_ERROR;
+
+	return m_con->wait( timeout_ms );
+}
+
 int wa::Components::WAC_Network_HTTPGet::run()
 {
 	int cnt = 0;
@@ -881,6 +889,7 @@ VCB( API_HTTPRECEIVER_ADDHEADER,                  addheader )
 VCB( API_HTTPRECEIVER_ADDHEADERVALUE,             addheadervalue )
 VCB( API_HTTPRECEIVER_CONNECT,                    connect )
 CB(  API_HTTPRECEIVER_RUN,                        run )
+CB(  API_HTTPRECEIVER_WAIT,                       wait )
 CB(  API_HTTPRECEIVER_GETSTATUS,                  get_status )
 CB(  API_HTTPRECEIVER_GETBYTESAVAILABLE,          bytes_available )
 CB(  API_HTTPRECEIVER_GETBYTES,                   get_bytes )
@@ -78,6 +78,7 @@ namespace wa
             void            connect( const char *url, int ver = 0, const char *requestmethod = "GET" );
 
             int             run();                  // returns: 0 if all is OK. -1 if error (call geterrorstr()). 1 if connection closed.
+            int             wait( int timeout_ms ); // blocks until there's network activity for run() or timeout_ms passes. see HTTPRECEIVER_WAIT_* enum
 
             int             get_status();           // returns 0 if connecting, 1 if reading headers, 2 if reading content, -1 if error.
 
@@ -23,6 +23,14 @@ enum
 	HTTPRECEIVER_RUN_CONNECTION_CLOSED = 1,
 };
 
+enum
+{
+	HTTPRECEIVER_WAIT_UNSUPPORTED      = -2, // older wac_network, caller should Sleep() instead
+	HTTPRECEIVER_WAIT_ERROR            = -1,
+	HTTPRECEIVER_WAIT_TIMEOUT          = 0,
+	HTTPRECEIVER_WAIT_READY            = 1,
+};
+
 
 class NOVTABLE api_httpreceiver : public Dispatchable
 {
@@ -43,6 +51,7 @@ public:
 	void            connect( const char *url, int ver = 0, const char *requestmethod = "GET" );
 
 	int             run();           // see HTTPRECEIVER_RUN_* enum for return values
+	int             wait( int timeout_ms ); // blocks until run() has network activity to process. see HTTPRECEIVER_WAIT_* enum for return values
 	int             get_status();    // see HTTPRECEIVER_STATUS_* enum for return values
 
 	int             bytes_available();
@@ -100,6 +109,8 @@ public:
 		API_HTTPRECEIVER_SET_SENDBUFSIZE            = 200,
 		API_HTTPRECEIVER_SET_ACCEPT_ALL_REPLY_CODES = 210,
 		API_HTTPRECEIVER_SET_PERSISTENT             = 220,
+
+		API_HTTPRECEIVER_WAIT                       = 230,
 	};
 
 };
@@ -148,6 +159,11 @@ inline int api_httpreceiver::run()
 	return _call( API_HTTPRECEIVER_RUN, (int)HTTPRECEIVER_RUN_ERROR );
 }
 
+inline int api_httpreceiver::wait( int timeout_ms )
+{
+	return _call( API_HTTPRECEIVER_WAIT, (int)HTTPRECEIVER_WAIT_UNSUPPORTED, timeout_ms );
+}
+
 inline int api_httpreceiver::get_status()
 {
 	return _call( API_HTTPRECEIVER_GETSTATUS, (int)HTTPRECEIVER_STATUS_ERROR );
@@ -223,6 +223,19 @@ void JNL_SSL_Connection::run( size_t max_send_bytes, size_t max_recv_bytes, size
 	WAC_Network_Connection::run( max_send_bytes, max_recv_bytes, bytes_sent, bytes_rcvd );
 }
 
+int JNL_SSL_Connection::wait( int timeout_ms )
+{
+	// OpenSSL might already have decrypted data buffered that select() won't know about
+	if ( m_ssl && SSL_pending( m_ssl ) > 0 )
+		return 1;
+
+	// during the handshake SSL might want to write even though our send buffer is empty, so don't block for long
+	if ( ( !m_bsslinit || forceConnect ) && timeout_ms > 10 )
+		timeout_ms = 10;
+
+	return WAC_Network_Connection::wait( timeout_ms );
+}
+
 /*
 **  init_ssl_connection:
 **  Returns true, meaning can continue
@@ -375,12 +375,65 @@ void Streams::setVideoTrack(int n)
 }
 
 
+/* seek tables are persisted in the settings folder, named after a hash of the full path and stream number.
+the cache records file size and modification time so stale ones are ignored */
+static bool GetSeekCacheFilename(nsavi::avi_reader *reader, int stream_number, wchar_t *cache_filename, size_t cache_filename_cch, uint64_t *file_size, uint64_t *file_time)
+{
+	wchar_t fn[MAX_PATH] = {0};
+	reader->GetFilename(fn, MAX_PATH);
+	if (!fn[0] || PathIsURLW(fn))
+		return false;
+
+	WIN32_FILE_ATTRIBUTE_DATA file_data;
+	if (!GetFileAttributesExW(fn, GetFileExInfoStandard, &file_data))
+		return false;
+	*file_size = ((uint64_t)file_data.nFileSizeHigh << 32) | file_data.nFileSizeLow;
+	*file_time = ((uint64_t)file_data.ftLastWriteTime.dwHighDateTime << 32) | file_data.ftLastWriteTime.dwLowDateTime;
+
+	uint64_t hash = 14695981039346656037ULL; // FNV-1a
+	for (const wchar_t *p=fn;*p;p++)
+	{
+		hash ^= (uint64_t)towlower(*p);
+		hash *= 1099511628211ULL;
+	}
+
+	if (!seek_cache_path[0])
+		return false;
+	CreateDirectoryW(seek_cache_path, NULL);
+	return SUCCEEDED(StringCchPrintfW(cache_filename, cache_filename_cch, L"%s\\%016I64x.%d.idx", seek_cache_path, hash, stream_number));
+}
+
+static bool ReadSeekCache(nsavi::avi_reader *reader, nsavi::SeekTable *seek_table)
+{
+	if (!seek_table)
+		return true;
+
+	wchar_t cache_filename[MAX_PATH] = {0};
+	uint64_t file_size, file_time;
+	if (!GetSeekCacheFilename(reader, seek_table->stream_number, cache_filename, MAX_PATH, &file_size, &file_time))
+		return false;
+
+	return seek_table->ReadCache(cache_filename, file_size, file_time);
+}
+
+static void WriteSeekCache(nsavi::avi_reader *reader, const nsavi::SeekTable *seek_table)
+{
+	if (!seek_table)
+		return;
+
+	wchar_t cache_filename[MAX_PATH] = {0};
+	uint64_t file_size, file_time;
+	if (GetSeekCacheFilename(reader, seek_table->stream_number, cache_filename, MAX_PATH, &file_size, &file_time))
+		seek_table->WriteCache(cache_filename, file_size, file_time);
+}
+
 bool SingleReaderLoop(nsavi::Demuxer &demuxer, nsavi::avi_reader *reader, nsavi::SeekTable *&audio_seek_table, nsavi::SeekTable *&video_seek_table)
 {
 	const void *input_buffer = 0;
 	uint16_t type = 0;
 	uint32_t input_buffer_bytes = 0;
 	bool idx1_searched=false;
+	bool seek_cache_valid=false;
 
 	HANDLE events[] = { killswitch, seek_event, audio_break, audio_resume };
 	void *data;
@@ -406,14 +459,19 @@ bool SingleReaderLoop(nsavi::Demuxer &demuxer, nsavi::avi_reader *reader, nsavi:
 					ResetEvent(seek_event); // reset this first so nothing aborts on it
 					if (!idx1_searched) 
 					{
-						nsavi::IDX1 *index;
-						ret = demuxer.GetSeekTable(&index);
-						if (ret == nsavi::READ_OK)
+						seek_cache_valid = ReadSeekCache(reader, video_seek_table);
+						seek_cache_valid = ReadSeekCache(reader, audio_seek_table) && seek_cache_valid;
+						if (!seek_cache_valid)
 						{
-							if (video_seek_table)
-								video_seek_table->AddIndex(index);
-							if (audio_seek_table)
-								audio_seek_table->AddIndex(index);
+							nsavi::IDX1 *index;
+							ret = demuxer.GetSeekTable(&index);
+							if (ret == nsavi::READ_OK)
+							{
+								if (video_seek_table)
+									video_seek_table->AddIndex(index);
+								if (audio_seek_table)
+									audio_seek_table->AddIndex(index);
+							}
 						}
 						idx1_searched=true;							
 					}
@@ -440,6 +498,13 @@ bool SingleReaderLoop(nsavi::Demuxer &demuxer, nsavi::avi_reader *reader, nsavi:
 						}
 					}
 
+					if (!seek_cache_valid)
+					{
+						WriteSeekCache(reader, video_seek_table);
+						WriteSeekCache(reader, audio_seek_table);
+						seek_cache_valid=true;
+					}
+
 					if (video_seek_table)
 					{
 						int curr_time = GetOutputTime();
@@ -565,6 +630,7 @@ bool MultiReaderLoop(nsavi::Demuxer &demuxer, nsavi::avi_reader *reader, nsavi::
 	uint16_t type = 0;
 	uint32_t input_buffer_bytes = 0;
 	bool idx1_searched=false;
+	bool seek_cache_valid=false;
 
 	HANDLE events[] = { killswitch, seek_event, audio_break, audio_resume};
 	void *data;
@@ -590,12 +656,17 @@ bool MultiReaderLoop(nsavi::Demuxer &demuxer, nsavi::avi_reader *reader, nsavi::
 					ResetEvent(seek_event); // reset this first so nothing aborts on it
 					if (!idx1_searched) 
 					{
-						nsavi::IDX1 *index;
-						ret = demuxer.GetSeekTable(&index);
-						if (ret == nsavi::READ_OK)
+						seek_cache_valid = ReadSeekCache(reader, video_seek_table);
+						seek_cache_valid = ReadSeekCache(reader, audio_seek_table) && seek_cache_valid;
+						if (!seek_cache_valid)
 						{
-							video_seek_table->AddIndex(index);
-							audio_seek_table->AddIndex(index);
+							nsavi::IDX1 *index;
+							ret = demuxer.GetSeekTable(&index);
+							if (ret == nsavi::READ_OK)
+							{
+								video_seek_table->AddIndex(index);
+								audio_seek_table->AddIndex(index);
+							}
 						}
 						idx1_searched=true;							
 					}
@@ -621,6 +692,13 @@ bool MultiReaderLoop(nsavi::Demuxer &demuxer, nsavi::avi_reader *reader, nsavi::
 						}
 					}
 
+					if (!seek_cache_valid)
+					{
+						WriteSeekCache(reader, video_seek_table);
+						WriteSeekCache(reader, audio_seek_table);
+						seek_cache_valid=true;
+					}
+
 					int curr_time = GetOutputTime();
 					int direction = (curr_time < this_seek_position)?nsavi::SeekTable::SEEK_FORWARD:nsavi::SeekTable::SEEK_BACKWARD;
 					const nsavi::SeekEntry *video_seek_entry=video_seek_table->GetSeekPoint(this_seek_position, curr_time, direction);
@@ -4,6 +4,7 @@
 #include "../nsavi/nsavi.h"
 #include "win32_avi_reader.h"
 #include "resource.h"
+#include <shlwapi.h>
 #include <strsafe.h>
 
 #define AVI_PLUGIN_VERSION L"0.78"
@@ -32,6 +33,7 @@ int video_only=0;
 In_Module *dshow_mod = 0;
 HMODULE in_dshow=0;
 wchar_t pluginName[256] = {0};
+wchar_t seek_cache_path[MAX_PATH] = {0};
 
 static int DoAboutMessageBox(HWND parent, wchar_t* title, wchar_t* message)
 {
@@ -65,6 +67,9 @@ int Init()
 					 WASABI_API_LNGSTRINGW(IDS_NULLSOFT_AVI), AVI_PLUGIN_VERSION);
 	plugin.description = (char*)pluginName;
 	SetFileExtensions();
+
+	const wchar_t *inipath = (wchar_t *)SendMessage(plugin.hMainWindow, WM_WA_IPC, 0, IPC_GETINIDIRECTORYW);
+	PathCombineW(seek_cache_path, inipath, L"Plugins\\in_avi");
 	return IN_INIT_SUCCESS;
 }
 
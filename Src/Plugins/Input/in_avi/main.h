@@ -10,6 +10,7 @@ extern int g_duration;
 extern nu::VideoClock video_clock;
 extern int video_only;
 extern HMODULE in_dshow;
+extern wchar_t seek_cache_path[MAX_PATH]; // folder for persisted seek tables
 
 /* InfoDialog.cpp */
 INT_PTR CALLBACK InfoDialog(HWND hwndDlg, UINT uMsg, WPARAM wParam, LPARAM lParam);
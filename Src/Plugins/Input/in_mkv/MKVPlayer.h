@@ -41,6 +41,7 @@ private:
 
 	// file position is restored at end of function
 	bool FindCues();
+	void SaveCues(); // writes cues to the cue cache
 
 	int ParseCluster(nsmkv::MKVReader *stream, uint64_t size, uint64_t *track_numbers, size_t track_numbers_len);
 
@@ -86,6 +87,10 @@ private:
 	bool cues_searched;
 	bool first_cluster_found;
 
+	/* cue cache */
+	wchar_t cache_filename[MAX_PATH];
+	uint64_t file_size, file_time; // cache is only valid if these match
+
 	/* player implementation */
 	nsmkv::MKVReader *main_reader; // also gets used as audio_stream
 	Nullsoft::Utility::LockGuard cluster_guard;	
@@ -13,9 +13,11 @@
 #include "svc_mkvdecoder.h"
 #include "ifc_mkvvideodecoder.h"
 #include "../nsmkv/file_mkv_reader.h"
+#include "../nsmkv/CueCache.h"
 #include <api/service/waservicefactory.h>
 #include <api/service/services.h>
 #include <windows.h>
+#include <shlwapi.h>
 #include <strsafe.h>
 
 // {B6CB4A7C-A8D0-4c55-8E60-9F7A7A23DA0F}
@@ -53,6 +55,24 @@ int MKVPlayer::MKVWait::WaitOrAbort(int time_in_ms)
 	}
 }
 
+/* benski> cue cache lives in the settings folder, named after a hash of the full path
+so it doesn't matter if the media is on read-only storage */
+static void GetCueCacheFilename(const wchar_t *filename, wchar_t *cache_filename, size_t cache_filename_cch)
+{
+	uint64_t hash = 14695981039346656037ULL; // FNV-1a
+	for (const wchar_t *p=filename;*p;p++)
+	{
+		hash ^= (uint64_t)towlower(*p);
+		hash *= 1099511628211ULL;
+	}
+
+	const wchar_t *inipath = (wchar_t *)SendMessage(plugin.hMainWindow, WM_WA_IPC, 0, IPC_GETINIDIRECTORYW);
+	wchar_t cache_path[MAX_PATH] = {0};
+	PathCombineW(cache_path, inipath, L"Plugins\\in_mkv");
+	CreateDirectoryW(cache_path, NULL);
+	StringCchPrintfW(cache_filename, cache_filename_cch, L"%s\\%016I64x.cue", cache_path, hash);
+}
+
 MKVPlayer::MKVPlayer(const wchar_t *_filename) : audio_output(&plugin)
 {
 	first_cluster_found = false;
@@ -63,6 +83,17 @@ MKVPlayer::MKVPlayer(const wchar_t *_filename) : audio_output(&plugin)
 	filename = _wcsdup(_filename);
 	m_needseek = -1;
 
+	cache_filename[0]=0;
+	file_size=0;
+	file_time=0;
+	WIN32_FILE_ATTRIBUTE_DATA file_data;
+	if (GetFileAttributesExW(filename, GetFileExInfoStandard, &file_data))
+	{
+		file_size = ((uint64_t)file_data.nFileSizeHigh << 32) | file_data.nFileSizeLow;
+		file_time = ((uint64_t)file_data.ftLastWriteTime.dwHighDateTime << 32) | file_data.ftLastWriteTime.dwLowDateTime;
+		GetCueCacheFilename(filename, cache_filename, MAX_PATH);
+	}
+
 	audio_decoder=0;
 	audio_track_num=0;
 	audio_output_len = 65536;
@@ -148,11 +179,23 @@ DWORD CALLBACK MKVThread(LPVOID param)
 	return ret;
 }
 
+void MKVPlayer::SaveCues()
+{
+	if (cache_filename[0] && !cues.cue_points.empty())
+		nsmkv::SaveCueCache(cache_filename, file_size, file_time, cues);
+}
+
 bool MKVPlayer::FindCues()
 {
 	if (cues_searched)
 		return true;
 
+	if (cache_filename[0] && nsmkv::LoadCueCache(cache_filename, file_size, file_time, cues))
+	{
+		cues_searched=true;
+		return true;
+	}
+
 	uint64_t original_position = main_reader->Tell();
 
 	// first, let's try the seek table
@@ -170,18 +213,27 @@ bool MKVPlayer::FindCues()
 				return false;
 			cues_searched=true;
 			main_reader->Seek(original_position);
+			SaveCues();
 			return true;
 		}
 	}
 
 	main_reader->Seek(segment_position); // TODO: keep track of how far Step() has gotten so we don't have to start from scratch
+	/* while we're walking the file looking for Cues, 
+	keep an index of cluster start times in case the file doesn't have any */
+	nsmkv::Cues cluster_cues;
 	/* --- TODO: make this block into a function in nsmkv --- */
 	while (1) // TODO: key off segment size to make sure we don't overread
 	{
 		uint64_t this_position = main_reader->Tell();
 		ebml_node node;
 		if (read_ebml_node(main_reader, &node) == 0)
-			return false;
+		{
+			if (cluster_cues.cue_points.empty())
+				return false;
+			cues.cue_points.swap(cluster_cues.cue_points);
+			break;
+		}
 
 		if (node.id != mkv_void)
 		{
@@ -195,14 +247,45 @@ bool MKVPlayer::FindCues()
 				return false;
 			break;
 		}
+		else if (node.id == mkv_segment_cluster)
+		{
+			uint64_t time_code;
+			uint64_t bytes_read = nsmkv::ReadClusterTimeCode(main_reader, node.size, &time_code);
+			if (bytes_read)
+			{
+				nsmkv::CuePoint *cue_point = new nsmkv::CuePoint;
+				cue_point->cue_time = time_code;
+				uint64_t track_numbers[] = {audio_track_num, video_track_num};
+				for (size_t i=0;i!=sizeof(track_numbers)/sizeof(*track_numbers);i++)
+				{
+					if (track_numbers[i])
+					{
+						nsmkv::CueTrackPosition *track_position = new nsmkv::CueTrackPosition;
+						track_position->track = track_numbers[i];
+						track_position->cluster_position = this_position-segment_position;
+						cue_point->cue_track_positions[track_position->track] = track_position;
+					}
+				}
+				cluster_cues.cue_points[cue_point->cue_time] = cue_point;
+			}
+			main_reader->Skip(node.size - bytes_read);
+		}
 		else
 		{
 			main_reader->Skip(node.size);
 		}
 	}
 	/* ------ */
+	for (nsmkv::Cues::CuePoints::iterator itr=cluster_cues.cue_points.begin();itr!=cluster_cues.cue_points.end();itr++)
+	{
+		nsmkv::CuePoint::CueTrackPositions &positions = itr->second->cue_track_positions;
+		for (nsmkv::CuePoint::CueTrackPositions::iterator pos=positions.begin();pos!=positions.end();pos++)
+			delete pos->second;
+		delete itr->second;
+	}
 	cues_searched=true;
 	main_reader->Seek(original_position);
+	SaveCues();
 	return true;
 }
 
@@ -77,6 +77,9 @@ public:
 
 	void setMetaCB( api_readercallback *cb )                          { metacb = cb; }
 
+	// waits for network activity rather than sleeping a fixed amount of time
+	void waitForData( int timeout_ms );
+
 	//static BOOL CALLBACK httpDlgProc(HWND hwndDlg, UINT uMsg, WPARAM wParam, LPARAM lParam);
 
 private:
@@ -189,13 +192,8 @@ int HttpReader::connect()
 	try
 	{
 		while ( killswitch >= 0 && httpGetter->run() == 0 && httpGetter->get_status() == 0 )
-		{
-#ifdef _WIN32
-			//Sleep( 50 );
-#else
-			usleep( 50000 );
-#endif
-		}
+			waitForData( 50 );
+
 		if ( killswitch )
 			return 0;
 
@@ -272,6 +270,18 @@ int HttpReader::connect()
 	return 1;
 }
 
+void HttpReader::waitForData( int timeout_ms )
+{
+	if ( httpGetter->wait( timeout_ms ) == HTTPRECEIVER_WAIT_UNSUPPORTED )
+	{
+#ifdef _WIN32
+		Sleep( timeout_ms );
+#else
+		usleep( timeout_ms * 1000 );
+#endif
+	}
+}
+
 int HttpReader::bytesAvailable()
 {
 	int code = httpGetter->run();
@@ -303,8 +313,10 @@ int HttpReader::read(int8_t *buffer, int length)
 			do
 			{
 				s = httpGetter->run();
+				if (s == 0 && httpGetter->get_status() != 2)
+					waitForData(50);
 			}
-			while (s == 0 && httpGetter->get_status() != 2);
+			while (s == 0 && httpGetter->get_status() != 2 && !killswitch);
 
 			// calculate the needed prebuffer size if it's a shoutcast stream
 			const char *icybr;
@@ -327,11 +339,7 @@ int HttpReader::read(int8_t *buffer, int length)
 //      JNL_Connection::state s = getter->get_state();
 			//    if (s == JNL_Connection::STATE_ERROR || s == JNL_Connection::STATE_CLOSED) break;
 			if (s == -1 || s == 1) break;
-#ifdef _WIN32
-			Sleep(50);
-#else
-      usleep(50000);
-#endif
+			waitForData(50);
 			if (last_pre != httpGetter->bytes_available() && !killswitch)
 			{
 // TODO:      if (!config_suppressstatus) api->core_setCustomMsg(0, StringPrintf(0, "Prebuffering : %i/%i bytes",httpGetter->bytes_available(),prebuffer_size));
@@ -472,11 +480,7 @@ int HttpReader::read(int8_t *buffer, int length)
 				}
 				else
 				{
-#ifdef _WIN32
-          Sleep(50);
-#else
-          usleep(50000);
-#endif
+					waitForData(50);
 				}
 				break;
 			}
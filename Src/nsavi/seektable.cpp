@@ -1,5 +1,6 @@
 #include "seektable.h"
 #include "demuxer.h"
+#include <stdio.h>
 
 static int GetStreamNumber(uint32_t id)
 {
@@ -174,4 +175,99 @@ bool nsavi::SeekTable::GetIndexLocation(int timestamp, uint64_t *position, uint6
 		}
 	}
 	return false;
-}
\ No newline at end of file
+}
+static const uint32_t seek_cache_magic = 'CIVA'; // AVIC
+static const uint32_t seek_cache_version = 1;
+
+struct SeekCacheHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint64_t file_size;
+	uint64_t file_time;
+	uint32_t stream_number;
+	uint32_t require_keyframes;
+	uint64_t entry_count;
+};
+
+struct SeekCacheEntry
+{
+	int32_t timestamp;
+	uint32_t absolute;
+	uint64_t file_position;
+	uint64_t stream_time;
+};
+
+bool nsavi::SeekTable::ReadCache(const wchar_t *cache_filename, uint64_t file_size, uint64_t file_time)
+{
+	FILE *f = _wfopen(cache_filename, L"rb");
+	if (!f)
+		return false;
+
+	SeekCacheHeader header;
+	if (fread(&header, sizeof(header), 1, f) != 1
+		|| header.magic != seek_cache_magic || header.version != seek_cache_version
+		|| header.file_size != file_size || header.file_time != file_time
+		|| header.stream_number != (uint32_t)stream_number || header.require_keyframes != (uint32_t)require_keyframes)
+	{
+		fclose(f);
+		return false;
+	}
+
+	SeekEntries cached_entries;
+	for (uint64_t i=0;i!=header.entry_count;i++)
+	{
+		SeekCacheEntry cache_entry;
+		if (fread(&cache_entry, sizeof(cache_entry), 1, f) != 1)
+		{
+			fclose(f);
+			return false;
+		}
+		SeekEntry &entry = cached_entries[cache_entry.timestamp];
+		entry.timestamp = cache_entry.timestamp;
+		entry.absolute = !!cache_entry.absolute;
+		entry.file_position = cache_entry.file_position;
+		entry.stream_time = cache_entry.stream_time;
+	}
+	fclose(f);
+
+	seek_entries.swap(cached_entries);
+	if (super_index)
+		indices_processed = super_index->indx.number_of_entries;
+	return true;
+}
+
+bool nsavi::SeekTable::WriteCache(const wchar_t *cache_filename, uint64_t file_size, uint64_t file_time) const
+{
+	if (seek_entries.empty())
+		return false;
+
+	FILE *f = _wfopen(cache_filename, L"wb");
+	if (!f)
+		return false;
+
+	SeekCacheHeader header;
+	header.magic = seek_cache_magic;
+	header.version = seek_cache_version;
+	header.file_size = file_size;
+	header.file_time = file_time;
+	header.stream_number = stream_number;
+	header.require_keyframes = require_keyframes;
+	header.entry_count = seek_entries.size();
+	bool success = fwrite(&header, sizeof(header), 1, f) == 1;
+
+	for (SeekEntries::const_iterator itr=seek_entries.begin();success && itr!=seek_entries.end();itr++)
+	{
+		SeekCacheEntry cache_entry;
+		cache_entry.timestamp = itr->second.timestamp;
+		cache_entry.absolute = itr->second.absolute;
+		cache_entry.file_position = itr->second.file_position;
+		cache_entry.stream_time = itr->second.stream_time;
+		success = fwrite(&cache_entry, sizeof(cache_entry), 1, f) == 1;
+	}
+	fclose(f);
+
+	if (!success) // don't leave a truncated cache lying around
+		_wremove(cache_filename);
+	return success;
+}
@@ -37,6 +37,11 @@ public:
 	// returns a recommend place to go hunting for an idx1, indx or ix## chunk
 	// usually based on indx super chunks already found in header_list
 	bool GetIndexLocation(int timestamp, uint64_t *position, uint64_t *start_time);
+
+	// persisted copy of seek_entries, only valid if file_size and file_time match what was saved
+	// on success, the indx super index is marked as fully processed so it won't be read again
+	bool ReadCache(const wchar_t *cache_filename, uint64_t file_size, uint64_t file_time);
+	bool WriteCache(const wchar_t *cache_filename, uint64_t file_size, uint64_t file_time) const;
 	
 	typedef std::map<int, SeekEntry> SeekEntries; // mapped to timestamp in milliseconds
 	SeekEntries seek_entries; 
@@ -136,6 +136,47 @@ uint64_t nsmkv::ReadCluster(nsmkv::MKVReader *reader, uint64_t size, nsmkv::Clus
 }
 
 
+// reads only as far as the cluster's time code, skipping anything in front of it.  used for building an index when the file has no Cues
+// returns bytes read.  0 means EOF or no time code found.  caller is responsible for skipping the rest of the cluster
+uint64_t nsmkv::ReadClusterTimeCode(nsmkv::MKVReader *reader, uint64_t size, uint64_t *time_code)
+{
+	uint64_t total_bytes_read=0;
+	while (size)
+	{
+		ebml_node node;
+		uint64_t bytes_read = read_ebml_node(reader, &node);
+
+		if (bytes_read == 0)
+			return 0;
+
+		// benski> checking bytes_read and node.size separately prevents possible integer overflow attack
+		if (bytes_read > size)
+			return 0;
+		total_bytes_read+=bytes_read;
+		size-=bytes_read;
+
+		if (node.size > size)
+			return 0;
+		total_bytes_read+=node.size;
+		size-=node.size;
+
+		switch(node.id)
+		{
+		case mkv_cluster_timecode:
+			if (read_unsigned(reader, node.size, time_code) == 0)
+				return 0;
+			return total_bytes_read;
+		case mkv_cluster_blockgroup:
+		case mkv_cluster_simpleblock:
+			return 0; // time code is required to come before any blocks
+		default:
+			ReadGlobal(reader, node.id, node.size);
+		}
+	}
+	return 0;
+}
+
+
 uint64_t nsmkv::ReadBlockBinary(nsmkv::MKVReader *reader, uint64_t size, nsmkv::BlockBinary &binary, uint64_t *allowed_track_numbers, size_t num_allowed_track_numbers)
 {
 	uint64_t orig_size = size;
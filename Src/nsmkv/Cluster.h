@@ -101,6 +101,7 @@ namespace nsmkv
 
 	};
 	uint64_t ReadCluster(MKVReader *reader, uint64_t size, nsmkv::Cluster &cluster);
+	uint64_t ReadClusterTimeCode(MKVReader *reader, uint64_t size, uint64_t *time_code);
 	uint64_t ReadBlockBinary(MKVReader *reader, uint64_t size, nsmkv::BlockBinary &binary, uint64_t *allowed_track_numbers, size_t num_allowed_track_numbers);
 	uint64_t ReadBlockGroup(MKVReader *reader, uint64_t size, nsmkv::Block &block, uint64_t *allowed_track_numbers, size_t num_allowed_track_numbers);
 }
\ No newline at end of file
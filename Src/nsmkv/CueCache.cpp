@@ -0,0 +1,102 @@
+#include "CueCache.h"
+#include <stdio.h>
+
+static const uint32_t cue_cache_magic = 'CVKM'; // MKVC
+
+struct CueCacheHeader
+{
+	uint32_t magic;
+	uint32_t version;
+	uint64_t file_size;
+	uint64_t file_time;
+	uint64_t cue_point_count;
+};
+
+struct CueCacheEntry
+{
+	uint64_t track;
+	uint64_t cluster_position;
+};
+
+bool nsmkv::LoadCueCache(const wchar_t *cache_filename, uint64_t file_size, uint64_t file_time, nsmkv::Cues &cues)
+{
+	FILE *f = _wfopen(cache_filename, L"rb");
+	if (!f)
+		return false;
+
+	CueCacheHeader header;
+	if (fread(&header, sizeof(header), 1, f) != 1
+		|| header.magic != cue_cache_magic || header.version != CUE_CACHE_VERSION
+		|| header.file_size != file_size || header.file_time != file_time)
+	{
+		fclose(f);
+		return false;
+	}
+
+	for (uint64_t i=0;i!=header.cue_point_count;i++)
+	{
+		uint64_t cue_time;
+		uint32_t position_count;
+		if (fread(&cue_time, sizeof(cue_time), 1, f) != 1 || fread(&position_count, sizeof(position_count), 1, f) != 1)
+		{
+			fclose(f);
+			return false;
+		}
+
+		CuePoint *cue_point = new CuePoint;
+		cue_point->cue_time = cue_time;
+		for (uint32_t j=0;j!=position_count;j++)
+		{
+			CueCacheEntry entry;
+			if (fread(&entry, sizeof(entry), 1, f) != 1)
+			{
+				delete cue_point;
+				fclose(f);
+				return false;
+			}
+			CueTrackPosition *track_position = new CueTrackPosition;
+			track_position->track = entry.track;
+			track_position->cluster_position = entry.cluster_position;
+			cue_point->cue_track_positions[track_position->track] = track_position;
+		}
+		cues.cue_points[cue_point->cue_time] = cue_point;
+	}
+	fclose(f);
+	return true;
+}
+
+bool nsmkv::SaveCueCache(const wchar_t *cache_filename, uint64_t file_size, uint64_t file_time, const nsmkv::Cues &cues)
+{
+	FILE *f = _wfopen(cache_filename, L"wb");
+	if (!f)
+		return false;
+
+	CueCacheHeader header;
+	header.magic = cue_cache_magic;
+	header.version = CUE_CACHE_VERSION;
+	header.file_size = file_size;
+	header.file_time = file_time;
+	header.cue_point_count = cues.cue_points.size();
+	bool success = fwrite(&header, sizeof(header), 1, f) == 1;
+
+	for (Cues::CuePoints::const_iterator itr=cues.cue_points.begin();success && itr!=cues.cue_points.end();itr++)
+	{
+		const CuePoint *cue_point = itr->second;
+		uint32_t position_count = (uint32_t)cue_point->cue_track_positions.size();
+		success = fwrite(&cue_point->cue_time, sizeof(cue_point->cue_time), 1, f) == 1
+			&& fwrite(&position_count, sizeof(position_count), 1, f) == 1;
+
+		for (CuePoint::CueTrackPositions::const_iterator pos=cue_point->cue_track_positions.begin();success && pos!=cue_point->cue_track_positions.end();pos++)
+		{
+			CueCacheEntry entry;
+			entry.track = pos->second->track;
+			entry.cluster_position = pos->second->cluster_position;
+			success = fwrite(&entry, sizeof(entry), 1, f) == 1;
+		}
+	}
+	fclose(f);
+
+	if (!success) // don't leave a truncated cache lying around
+		_wremove(cache_filename);
+	return success;
+}
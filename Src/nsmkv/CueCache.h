@@ -0,0 +1,16 @@
+#pragma once
+#include <bfc/platform/types.h>
+#include "Cues.h"
+
+/* benski> persisted copy of the Cues (or the cluster index we built ourselves when the file has no Cues)
+so that re-opening a big file doesn't need to re-read or re-scan anything before the first seek.
+the cache is only trusted if the file size and modification time match what we saved */
+namespace nsmkv
+{
+	enum
+	{
+		CUE_CACHE_VERSION = 1,
+	};
+	bool LoadCueCache(const wchar_t *cache_filename, uint64_t file_size, uint64_t file_time, nsmkv::Cues &cues);
+	bool SaveCueCache(const wchar_t *cache_filename, uint64_t file_size, uint64_t file_time, const nsmkv::Cues &cues);
+}
@@ -316,6 +316,86 @@ void JNL_Connection::run(size_t max_send_bytes, size_t max_recv_bytes, size_t *b
 	}
 }
 
+int JNL_Connection::get_wait_flags()
+{
+	switch (m_state)
+	{
+	case STATE_RESOLVING:
+	case STATE_RESOLVED:
+		// DNS is resolved on another thread so we have no socket to wait on yet
+		return WAIT_RETRY;
+	case STATE_CONNECTING:
+		return WAIT_WRITE;
+	case STATE_CONNECTED:
+	case STATE_CLOSING:
+		{
+			int flags = WAIT_NONE;
+			if (recv_buffer.avail())
+				flags |= WAIT_READ;
+			if (!send_buffer.empty())
+				flags |= WAIT_WRITE;
+			return flags; // WAIT_NONE if the receive buffer is full and there's nothing to send, waiting won't accomplish anything
+		}
+	default:
+		return WAIT_NONE;
+	}
+}
+
+/* blocks until there is something for run() to do or timeout_ms elapses, so callers don't have to Sleep() between run() calls.
+returns 1 if the socket is ready (or the state changed), 0 on timeout, -1 on error */
+int JNL_Connection::wait(int timeout_ms)
+{
+	switch (m_state)
+	{
+	case STATE_RESOLVING:
+	case STATE_RESOLVED:
+	case STATE_CONNECTING:
+	case STATE_CONNECTED:
+	case STATE_CLOSING:
+		break;
+	default:
+		return -1;
+	}
+
+	int flags = get_wait_flags();
+	if (flags == WAIT_NONE)
+		return 1;
+
+	if (flags & WAIT_RETRY)
+	{
+		if (timeout_ms < 0 || timeout_ms > 10)
+			timeout_ms = 10;
+		if (!(flags & (WAIT_READ|WAIT_WRITE)))
+		{
+			// nothing to select() on, so nap briefly and let run() check on things
+#ifdef _WIN32
+			Sleep(timeout_ms);
+#else
+			usleep(timeout_ms*1000);
+#endif
+			return 1;
+		}
+	}
+
+	fd_set f[3];
+	FD_ZERO(&f[0]);
+	FD_ZERO(&f[1]);
+	FD_ZERO(&f[2]);
+	if (flags & WAIT_READ)
+		FD_SET(m_socket,&f[0]);
+	if (flags & WAIT_WRITE)
+		FD_SET(m_socket,&f[1]);
+	FD_SET(m_socket,&f[2]);
+
+	struct timeval tv;
+	tv.tv_sec = timeout_ms / 1000;
+	tv.tv_usec = (timeout_ms % 1000) * 1000;
+	int ret = select((int)m_socket+1,&f[0],&f[1],&f[2],timeout_ms<0?NULL:&tv);
+	if (ret == -1)
+		return -1;
+	return ret?1:0;
+}
+
 void JNL_Connection::on_socket_connected(void)
 {
 	return;
@@ -13,6 +13,8 @@
 **      resolved if possible).
 **   3. call run() with the maximum send/recv amounts, and optionally parameters
 **      so you can tell how much has been send/received. You want to do this a lot, while:
+**      (instead of sleeping between calls to run(), you can call wait() with a timeout,
+**      which returns as soon as the socket is ready)
 **   4. check get_state() to check the state of the connection. The states are:
 **        JNL_Connection::STATE_ERROR
 **          - an error has occured on the connection. the connection has closed,
@@ -101,6 +103,17 @@ public:
 	**  Need to make this virtual to ensure SSL can init properly
 	*/
 	virtual void    run( size_t max_send_bytes = -1, size_t max_recv_bytes = -1, size_t *bytes_sent = NULL, size_t *bytes_rcvd = NULL );
+	virtual int     wait( int timeout_ms );                          // waits for socket readiness. returns 1 if run() has work to do, 0 on timeout, -1 on error
+
+	enum
+	{
+		WAIT_NONE  = 0,                                                // don't wait, run() has work to do right now (or the connection is finished)
+		WAIT_READ  = 1,
+		WAIT_WRITE = 2,
+		WAIT_RETRY = 4,                                                // no socket event to wait for yet (e.g. DNS), call run() again shortly
+	};
+	virtual int     get_wait_flags();                                 // what socket readiness run() is waiting on in the current state.  used by wait() and JNL_Reactor
+	SOCKET          get_socket()                                      { return m_socket; }
 
 	int             get_state()                                       { return m_state; }
 	char           *get_errstr()                                      { return m_errorstr; }
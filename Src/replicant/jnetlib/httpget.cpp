@@ -509,6 +509,14 @@ const char *JNL_HTTPGet::getheader( const char *headername )
 	return ret;
 }
 
+int JNL_HTTPGet::wait( int timeout_ms )
+{
+	if ( m_http_state == -1 || !m_con )
+		return -1;
+
+	return m_con->wait( timeout_ms );
+}
+
 int JNL_HTTPGet::run()
 {
 	int cnt = 0;
@@ -19,6 +19,8 @@
 **   4. Call run() once in a while, checking to see if it returns -1 
 **      (if it does return -1, call geterrorstr() to see what the error is).
 **      (if it returns 1, no big deal, the connection has closed).
+**      If you're on a thread of your own, call wait() between run() calls
+**      rather than sleeping, so that you wake up as soon as data arrives.
 **   5. While you're at it, you can call bytes_available() to see if any data
 **      from the http stream is available, or getheader() to see if any headers
 **      are available, or getreply() to see the HTTP reply, or getallheaders() 
@@ -66,6 +68,7 @@ public:
 	void connect(const char *url, int ver=0, const char *requestmethod="GET");
 
 	int run(); // returns: 0 if all is OK. -1 if error (call geterrorstr()). 1 if connection closed.
+	int wait(int timeout_ms); // blocks until there's network activity for run() to process or timeout_ms passes. returns 1 if ready, 0 on timeout, -1 on error
 
 	int   get_status(); // returns 0 if connecting, 1 if reading headers, 
                         // 2 if reading content, -1 if error.
@@ -41,6 +41,12 @@ void jnl_connection_run(jnl_connection_t _connection, size_t max_send_bytes, siz
 	connection->run(max_send_bytes, max_receive_bytes, bytes_sent, bytes_received); 
 }
 
+int jnl_connection_wait(jnl_connection_t _connection, int timeout_ms)
+{
+	JNL_Connection *connection = (JNL_Connection *)_connection;
+	return connection->wait(timeout_ms);
+}
+
 int jnl_connection_get_state(jnl_connection_t _connection)
 {
 	JNL_Connection *connection = (JNL_Connection *)_connection;
@@ -214,6 +220,12 @@ int jnl_http_run(jnl_http_t _http)
 	return http->run();
 }
 
+int jnl_http_wait(jnl_http_t _http, int timeout_ms)
+{
+	JNL_HTTPGet *http = (JNL_HTTPGet *)_http;
+	return http->wait(timeout_ms);
+}
+
 size_t jnl_http_get_bytes(jnl_http_t _http, void *buf, size_t len)
 {
 	JNL_HTTPGet *http = (JNL_HTTPGet *)_http;
@@ -67,6 +67,7 @@ JNL_API void jnl_quit();
 JNL_API jnl_connection_t jnl_connection_create( jnl_dns_t dns, size_t sendbufsize, size_t recvbufsize );
 JNL_API jnl_connection_t jnl_sslconnection_create( jnl_dns_t dns, size_t sendbufsize, size_t recvbufsize );
 JNL_API void jnl_connection_run( jnl_connection_t connection, size_t max_send_bytes, size_t max_receive_bytes, size_t *bytes_sent, size_t *bytes_received );
+JNL_API int jnl_connection_wait( jnl_connection_t connection, int timeout_ms ); /* 1 if ready, 0 on timeout, -1 on error */
 JNL_API int jnl_connection_get_state( jnl_connection_t connection );
 JNL_API size_t jnl_connection_send_bytes_available( jnl_connection_t connection );
 JNL_API size_t jnl_connection_receive_bytes_available( jnl_connection_t connection );
@@ -109,6 +110,7 @@ JNL_API void jnl_http_allow_accept_all_reply_codes( jnl_http_t http );
 /* run & status stuff */
 JNL_API void jnl_http_connect( jnl_http_t http, const char *url, int http_version, const char *method );
 JNL_API int jnl_http_run( jnl_http_t http );
+JNL_API int jnl_http_wait( jnl_http_t http, int timeout_ms ); /* 1 if ready, 0 on timeout, -1 on error */
 JNL_API int jnl_http_get_status( jnl_http_t http );
 JNL_API int jnl_http_getreplycode( jnl_http_t http );
 JNL_API const char *jnl_http_getreply( jnl_http_t http );
@@ -75,7 +75,7 @@ int JNL_Listen::Initialize(addrinfo *address, size_t index)
 			m_socket=-1;
 			return NErr_Error;
 		}
-		else if (::listen(m_socket,8)==-1) 
+		else if (::listen(m_socket,SOMAXCONN)==-1) 
 		{
 			closesocket(m_socket);
 			m_socket=-1;
@@ -33,6 +33,7 @@ public:
     JNL_Connection *get_connect( size_t sendbufsize = 8192, size_t recvbufsize = 8192 );
     unsigned short  get_port();
     int             is_error( void )                                  { return ( m_socket < 0 ); }
+    SOCKET          get_socket()                                      { return m_socket; }
 
     socklen_t       get_address( sockaddr *address, socklen_t *address_len );
 
@@ -0,0 +1,379 @@
+/*
+** JNetLib
+** Copyright (C) 2013 Nullsoft, Inc.
+** Author: Ben Allison
+** File: reactor.cpp - JNL reactor implementation
+** License: see jnetlib.h
+*/
+
+#include "netinc.h"
+#include "reactor.h"
+#include "foundation/error.h"
+#include <new>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#elif defined(_WIN32)
+#define poll WSAPoll
+typedef WSAPOLLFD pollfd;
+#else
+#include <poll.h>
+#endif
+
+enum
+{
+	EVENT_READ  = 1,
+	EVENT_WRITE = 2,
+};
+
+JNL_Reactor::JNL_Reactor()
+{
+	in_run=false;
+#ifdef __linux__
+	epoll_fd=-1;
+#endif
+}
+
+JNL_Reactor::~JNL_Reactor()
+{
+	for (Entries::iterator itr=listeners.begin();itr!=listeners.end();itr++)
+	{
+		(*itr)->listen->Release();
+		delete *itr;
+	}
+
+	for (Connections::iterator itr=connections.begin();itr!=connections.end();itr++)
+	{
+		itr->second->connection->Release();
+		delete itr->second;
+	}
+
+	Purge();
+
+#ifdef __linux__
+	if (epoll_fd >= 0)
+		close(epoll_fd);
+#endif
+}
+
+int JNL_Reactor::Initialize()
+{
+#ifdef __linux__
+	epoll_fd = epoll_create1(EPOLL_CLOEXEC);
+	if (epoll_fd < 0)
+		return NErr_Error;
+#endif
+	return NErr_Success;
+}
+
+int JNL_Reactor::add_listen(JNL_Listen *listen, JNL_ReactorCallback *callback, size_t sendbufsize, size_t recvbufsize)
+{
+	if (!listen || !callback)
+		return NErr_NullPointer;
+
+	if (listen->is_error())
+		return NErr_BadParameter;
+
+	Entry *entry = new (std::nothrow) Entry;
+	if (!entry)
+		return NErr_OutOfMemory;
+
+	entry->listen=listen;
+	entry->connection=0;
+	entry->callback=callback;
+	entry->sendbufsize=sendbufsize;
+	entry->recvbufsize=recvbufsize;
+	entry->socket=-1;
+	entry->events=0;
+	entry->ready=false;
+	entry->removed=false;
+	Register(entry, listen->get_socket(), EVENT_READ);
+
+	listen->Retain();
+	listeners.push_back(entry);
+	return NErr_Success;
+}
+
+void JNL_Reactor::remove_listen(JNL_Listen *listen)
+{
+	for (Entries::iterator itr=listeners.begin();itr!=listeners.end();itr++)
+	{
+		if ((*itr)->listen == listen)
+		{
+			Entry *entry = *itr;
+			listeners.erase(itr);
+			Remove(entry);
+			return;
+		}
+	}
+}
+
+int JNL_Reactor::add_connection(JNL_Connection *connection, JNL_ReactorCallback *callback)
+{
+	if (!connection || !callback)
+		return NErr_NullPointer;
+
+	if (connections.find(connection) != connections.end())
+		return NErr_Error;
+
+	Entry *entry = new (std::nothrow) Entry;
+	if (!entry)
+		return NErr_OutOfMemory;
+
+	entry->listen=0;
+	entry->connection=connection;
+	entry->callback=callback;
+	entry->sendbufsize=0;
+	entry->recvbufsize=0;
+	entry->socket=-1;
+	entry->events=0;
+	entry->ready=false;
+	entry->removed=false;
+
+	connection->Retain();
+	connections[connection]=entry;
+	return NErr_Success;
+}
+
+void JNL_Reactor::remove_connection(JNL_Connection *connection)
+{
+	Connections::iterator itr = connections.find(connection);
+	if (itr != connections.end())
+	{
+		Entry *entry = itr->second;
+		connections.erase(itr);
+		Remove(entry);
+	}
+}
+
+void JNL_Reactor::Remove(Entry *entry)
+{
+	// only unregister if the socket is still the one we registered.  a closed socket drops out of epoll by itself,
+	// and its descriptor might already belong to someone else
+	SOCKET socket = entry->listen?entry->listen->get_socket():entry->connection->get_socket();
+	if (socket == entry->socket)
+		Register(entry, socket, 0);
+
+	if (entry->listen)
+		entry->listen->Release();
+	else
+		entry->connection->Release();
+	entry->listen=0;
+	entry->connection=0;
+	entry->removed=true;
+
+	if (in_run)
+		removed_entries.push_back(entry); // run() might still be holding onto it
+	else
+		delete entry;
+}
+
+void JNL_Reactor::Purge()
+{
+	for (Entries::iterator itr=removed_entries.begin();itr!=removed_entries.end();itr++)
+		delete *itr;
+	removed_entries.clear();
+}
+
+/* keeps the OS-side registration in sync with what the entry wants.  only does a syscall when something changed */
+void JNL_Reactor::Register(Entry *entry, SOCKET socket, int events)
+{
+	if (socket != entry->socket)
+	{
+		// the old socket was closed (which unregistered it) or we never had one
+		entry->socket=socket;
+		entry->events=0;
+	}
+
+	if (socket < 0)
+		return;
+
+#ifdef __linux__
+	if (events == entry->events)
+		return;
+
+	epoll_event event;
+	memset(&event, 0, sizeof(event));
+	if (events & EVENT_READ)
+		event.events |= EPOLLIN;
+	if (events & EVENT_WRITE)
+		event.events |= EPOLLOUT;
+	event.data.ptr = entry;
+
+	if (!events)
+		epoll_ctl(epoll_fd, EPOLL_CTL_DEL, socket, &event);
+	else if (!entry->events)
+		epoll_ctl(epoll_fd, EPOLL_CTL_ADD, socket, &event);
+	else if (epoll_ctl(epoll_fd, EPOLL_CTL_MOD, socket, &event) == -1 && errno == ENOENT)
+		epoll_ctl(epoll_fd, EPOLL_CTL_ADD, socket, &event);
+#endif
+
+	entry->events=events;
+}
+
+void JNL_Reactor::Accept(Entry *entry)
+{
+	// the listen socket is non-blocking, so take everything that's queued up
+	JNL_Connection *connection;
+	while (!entry->removed && (connection = entry->listen->get_connect(entry->sendbufsize, entry->recvbufsize)) != 0)
+	{
+		if (entry->callback->OnAccept(entry->listen, connection))
+			add_connection(connection, entry->callback);
+	}
+}
+
+void JNL_Reactor::Dispatch(Entry *entry)
+{
+	if (!entry->ready)
+	{
+		entry->ready=true;
+		ready.push_back(entry);
+	}
+}
+
+int JNL_Reactor::run(int timeout_ms)
+{
+	in_run=true;
+
+	/* figure out what everyone is waiting for.  this doesn't touch the OS unless something changed */
+#ifndef __linux__
+	std::vector<pollfd> fds;
+	Entries fd_entries;
+	fds.reserve(listeners.size() + connections.size());
+	fd_entries.reserve(listeners.size() + connections.size());
+	for (Entries::iterator itr=listeners.begin();itr!=listeners.end();itr++)
+	{
+		pollfd fd;
+		fd.fd = (*itr)->listen->get_socket();
+		fd.events = POLLIN;
+		fd.revents = 0;
+		fds.push_back(fd);
+		fd_entries.push_back(*itr);
+	}
+#endif
+
+	for (Connections::iterator itr=connections.begin();itr!=connections.end();itr++)
+	{
+		Entry *entry = itr->second;
+		JNL_Connection *connection = entry->connection;
+		int events=0;
+		switch (connection->get_state())
+		{
+		case JNL_Connection::STATE_ERROR:
+		case JNL_Connection::STATE_NOCONNECTION:
+		case JNL_Connection::STATE_CLOSED:
+			break; // nothing left for run() to do.  the callback heard about it the last time around
+		default:
+			{
+				int flags = connection->get_wait_flags();
+#ifdef _WIN32
+				// WSAPoll doesn't report failed connects on older versions of Windows, so check back periodically
+				if (connection->get_state() == JNL_Connection::STATE_CONNECTING)
+					flags |= JNL_Connection::WAIT_RETRY;
+#endif
+				if (flags == JNL_Connection::WAIT_NONE)
+				{
+					timeout_ms=0; // work to do right now, so don't block
+					Dispatch(entry);
+					break;
+				}
+
+				if (flags & JNL_Connection::WAIT_READ)
+					events |= EVENT_READ;
+				if (flags & JNL_Connection::WAIT_WRITE)
+					events |= EVENT_WRITE;
+
+				if (flags & JNL_Connection::WAIT_RETRY)
+				{
+					if (timeout_ms < 0 || timeout_ms > 10)
+						timeout_ms = 10;
+					Dispatch(entry);
+				}
+			}
+			break;
+		}
+
+		Register(entry, connection->get_socket(), events);
+#ifndef __linux__
+		if (entry->socket >= 0 && events)
+		{
+			pollfd fd;
+			fd.fd = entry->socket;
+			fd.events = 0;
+			if (events & EVENT_READ)
+				fd.events |= POLLIN;
+			if (events & EVENT_WRITE)
+				fd.events |= POLLOUT;
+			fd.revents = 0;
+			fds.push_back(fd);
+			fd_entries.push_back(entry);
+		}
+#endif
+	}
+
+	/* wait */
+	int ret=0;
+#ifdef __linux__
+	epoll_event events[256];
+	int count = epoll_wait(epoll_fd, events, sizeof(events)/sizeof(*events), timeout_ms);
+	if (count < 0 && errno != EINTR)
+		ret=-1;
+
+	for (int i=0;i<count;i++)
+	{
+		Entry *entry = (Entry *)events[i].data.ptr;
+		if (entry->listen)
+			Accept(entry);
+		else
+			Dispatch(entry);
+	}
+#else
+	if (!fds.empty())
+	{
+		int count = poll(&fds[0], (unsigned long)fds.size(), timeout_ms);
+		if (count < 0)
+			ret=-1;
+
+		for (size_t i=0;i<fds.size() && count > 0;i++)
+		{
+			if (fds[i].revents)
+			{
+				count--;
+				Entry *entry = fd_entries[i];
+				if (entry->listen)
+					Accept(entry);
+				else
+					Dispatch(entry);
+			}
+		}
+	}
+	else if (timeout_ms > 0)
+	{
+#ifdef _WIN32
+		Sleep(timeout_ms);
+#else
+		usleep(timeout_ms*1000);
+#endif
+	}
+#endif
+
+	/* run everything that's ready.  callbacks are free to add and remove connections */
+	size_t num_ready = ready.size();
+	for (size_t i=0;i<num_ready;i++)
+	{
+		Entry *entry = ready[i];
+		entry->ready=false;
+		if (!entry->removed)
+		{
+			entry->connection->run();
+			entry->callback->OnActivity(entry->connection);
+			if (ret >= 0)
+				ret++;
+		}
+	}
+	ready.clear();
+
+	in_run=false;
+	Purge();
+	return ret;
+}
@@ -0,0 +1,95 @@
+/*
+** JNetLib
+** Copyright (C) 2013 Nullsoft, Inc.
+** Author: Ben Allison
+** File: reactor.h - JNL interface for driving many connections from one thread
+** License: see jnetlib.h
+**
+** Usage:
+**   1. Create a JNL_Reactor object, and call Initialize()
+**   2. call add_listen() with a JNL_Listen to have incoming connections accepted
+**      for you.  The callback's OnAccept() is called for each new connection and
+**      owns the reference to it.  Return true to have the reactor drive the new
+**      connection as well (it takes its own reference).
+**   3. call add_connection() for any other JNL_Connection you want driven
+**      (for a JNL_HTTPServ, pass its get_con()).
+**   4. call run() with a timeout in a loop on your network thread.  It blocks
+**      until at least one socket is ready (epoll on linux, poll()/WSAPoll()
+**      elsewhere), calls run() on only the connections that are ready, and then
+**      calls OnActivity() for each of them.  Idle connections are never run().
+**   5. call remove_connection() when you're done with a connection.  It is safe
+**      to call from inside a callback.  The reactor holds a reference to every
+**      connection and listen that was added.
+*/
+
+#ifndef _REACTOR_H_
+#define _REACTOR_H_
+
+#include "connection.h"
+#include "listen.h"
+#include <vector>
+#include <map>
+
+class JNL_ReactorCallback
+{
+public:
+	// connection->run() has already been called
+	virtual void OnActivity( JNL_Connection *connection )=0;
+	// return true to have the reactor drive the new connection
+	virtual bool OnAccept( JNL_Listen *listen, JNL_Connection *connection ) { return false; }
+};
+
+class JNL_Reactor
+{
+public:
+	JNL_Reactor();
+	~JNL_Reactor();
+
+	int  Initialize();
+
+	int  add_listen( JNL_Listen *listen, JNL_ReactorCallback *callback, size_t sendbufsize = 8192, size_t recvbufsize = 8192 );
+	void remove_listen( JNL_Listen *listen );
+
+	int  add_connection( JNL_Connection *connection, JNL_ReactorCallback *callback );
+	void remove_connection( JNL_Connection *connection );
+
+	// returns number of connections that had activity, 0 on timeout, -1 on error
+	int  run( int timeout_ms );
+
+	size_t get_num_connections()                                      { return connections.size(); }
+
+private:
+	struct Entry
+	{
+		JNL_Listen          *listen;        // exactly one of listen and connection is set
+		JNL_Connection      *connection;
+		JNL_ReactorCallback *callback;
+		size_t               sendbufsize;   // for accepted connections
+		size_t               recvbufsize;
+		SOCKET               socket;        // socket we registered.  changes after DNS resolution
+		int                  events;        // what we registered for
+		bool                 ready;         // already queued to run() this time around
+		bool                 removed;
+	};
+
+	void Accept( Entry *entry );
+	void Dispatch( Entry *entry );
+	void Remove( Entry *entry );
+	void Purge();
+
+	void Register( Entry *entry, SOCKET socket, int events );
+
+	typedef std::vector<Entry *> Entries;
+	Entries listeners;
+	typedef std::map<JNL_Connection *, Entry *> Connections;
+	Connections connections;
+	Entries ready;
+	Entries removed_entries; // freed when run() is done with them, so callbacks can remove things safely
+	bool in_run;
+
+#ifdef __linux__
+	int epoll_fd;
+#endif
+};
+
+#endif // _REACTOR_H_
@@ -223,6 +223,19 @@ void JNL_SSL_Connection::run(size_t max_send_bytes, size_t max_recv_bytes, size_
 	JNL_Connection::run(max_send_bytes, max_recv_bytes, bytes_sent, bytes_rcvd);
 }
 
+int JNL_SSL_Connection::get_wait_flags()
+{
+	// OpenSSL might already have decrypted data buffered that the socket won't tell us about
+	if (m_ssl && SSL_pending(m_ssl) > 0)
+		return WAIT_NONE;
+
+	int flags = JNL_Connection::get_wait_flags();
+	// during the handshake SSL might want to write even though our send buffer is empty, so don't block for long
+	if (flags != WAIT_NONE && (!m_bsslinit || forceConnect))
+		flags |= WAIT_RETRY;
+	return flags;
+}
+
 /*
 **  init_ssl_connection:
 **  Returns true, meaning can continue
@@ -34,6 +34,7 @@ public:
 
 	virtual void    connect( SOCKET sock, sockaddr *addr, socklen_t length /* of addr */ ); // used by the listen object, usually not needed by users.
 	virtual void    run( size_t max_send_bytes = -1, size_t max_recv_bytes = -1, size_t *bytes_sent = NULL, size_t *bytes_rcvd = NULL );
+	virtual int     get_wait_flags();
 
 	/*
 	**  Joshua Teitelbaum 1/27/2006 Adding new BSD socket analogues for SSL compatibility